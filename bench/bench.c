@@ -0,0 +1,155 @@
+#include "bench.h"
+#include <stdlib.h>
+
+#define       SIZE 64
+
+static fun_t *bench[SIZE];
+static int    count = 0;
+static bool   cyccnt = false;
+#ifdef BENCH_JSON
+static int    records = 0;
+#endif
+
+void bench_add(fun_t *fun)
+{
+	ASSERT(count < SIZE);
+	bench[count++] = fun;
+}
+
+uint32_t bench_clock()
+{
+#ifdef SysTick_LOAD_RELOAD_Msk
+	cnt_t    cnt;
+	uint32_t val;
+#endif
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+	if (cyccnt)
+		return DWT->CYCCNT;
+#endif
+#ifdef SysTick_LOAD_RELOAD_Msk
+	// sub-tick resolution from the SysTick counter driving the system tick
+	do { cnt = sys_time(); val = SysTick->VAL; } while (cnt != sys_time());
+	return (uint32_t)cnt * (SysTick->LOAD + 1) + SysTick->LOAD - val;
+#else
+	return (uint32_t)sys_time() * (CPU_FREQUENCY / OS_FREQUENCY);
+#endif
+}
+
+static void bench_print(const char *name, unsigned param, unsigned loops, uint32_t cycles, bench_stat_t *stat)
+{
+	unsigned long cpo = (unsigned long)((uint64_t)cycles * 10 / loops);
+	unsigned long ops = cycles ? (unsigned long)((uint64_t)loops * CPU_FREQUENCY / cycles) : 0;
+
+#ifdef BENCH_JSON
+	printf("%s{\"name\":\"%s\",\"param\":%u,\"count\":%u,\"cycles\":%lu,\"cycles/op\":%lu.%lu,\"ops/s\":%lu",
+	       records++ ? ",\n" : "", name, param, loops, (unsigned long)cycles, cpo / 10, cpo % 10, ops);
+	if (stat)
+		printf(",\"min\":%lu,\"max\":%lu", (unsigned long)stat->min, (unsigned long)stat->max);
+	printf("}");
+#else
+	printf("%s,%u,%u,%lu,%lu.%lu,%lu", name, param, loops, (unsigned long)cycles, cpo / 10, cpo % 10, ops);
+	if (stat)
+		printf(",%lu,%lu\n", (unsigned long)stat->min, (unsigned long)stat->max);
+	else
+		printf(",,\n");
+#endif
+}
+
+void bench_report(const char *name, unsigned param, unsigned loops, uint32_t cycles)
+{
+	bench_print(name, param, loops, cycles, NULL);
+}
+
+void bench_stat_init(bench_stat_t *stat)
+{
+	stat->count = 0;
+	stat->min = UINT32_MAX;
+	stat->max = 0;
+	stat->sum = 0;
+}
+
+void bench_stat_add(bench_stat_t *stat, uint32_t cycles)
+{
+	stat->count++;
+	stat->sum += cycles;
+	if (stat->min > cycles) stat->min = cycles;
+	if (stat->max < cycles) stat->max = cycles;
+}
+
+void bench_stat_report(const char *name, unsigned param, bench_stat_t *stat)
+{
+	if (stat->count == 0)
+		return;
+	bench_print(name, param, stat->count, stat->sum, stat);
+}
+
+#ifdef BENCH_SEMIHOSTING
+void initialise_monitor_handles(void);
+#endif
+
+static void bench_init()
+{
+	TEST_Notify();
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	cyccnt = DWT->CYCCNT != DWT->CYCCNT; // qemu does not emulate the cycle counter
+#endif
+#ifdef BENCH_SEMIHOSTING
+	initialise_monitor_handles();
+#endif
+	LED_Init();
+#ifdef BENCH_JSON
+	printf("[\n");
+#else
+	printf("name,param,count,cycles,cycles/op,ops/s,min,max\n");
+#endif
+}
+
+static void bench_fini()
+{
+	TEST_Notify();
+#ifdef BENCH_JSON
+	printf("\n]\n");
+#endif
+	LEDs = 15;
+#ifdef BENCH_SEMIHOSTING
+	exit(0); // ends the qemu session
+#endif
+}
+
+int main()
+{
+	int i;
+
+	bench_init();
+
+	BENCH_AddUnit(bench_alloc);
+	BENCH_AddUnit(bench_event);
+	BENCH_AddUnit(bench_flag);
+	BENCH_AddUnit(bench_semaphore);
+	BENCH_AddUnit(bench_mutex);
+	BENCH_AddUnit(bench_memory_pool);
+	BENCH_AddUnit(bench_raw_buffer);
+	BENCH_AddUnit(bench_message_queue);
+	BENCH_AddUnit(bench_mailbox_queue);
+	BENCH_AddUnit(bench_event_queue);
+	BENCH_AddUnit(bench_job_queue);
+	BENCH_AddUnit(bench_timer);
+	BENCH_AddUnit(bench_task);
+	BENCH_AddUnit(bench_state_machine);
+	BENCH_AddUnit(bench_rhealstone);
+	BENCH_AddUnit(bench_schedulability);
+
+	size_t h = sys_heapSize();
+	for (i = 0; i < count; i++)
+	{
+		bench[i]();
+		ASSERT(h==sys_heapSize());
+	}
+
+	bench_fini();
+
+	tsk_stop();
+}
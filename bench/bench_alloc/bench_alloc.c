@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_alloc()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_alloc_trace);
+	BENCH_Add(bench_alloc_objects);
+}
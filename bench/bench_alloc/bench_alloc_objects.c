@@ -0,0 +1,54 @@
+#include "bench.h"
+
+// create/delete cost of dynamically allocated kernel objects (as in test_alloc_2 and test_alloc_3)
+
+#define SIZE sizeof(unsigned)
+
+static void *new_sem(void)    { return sem_create(0, semBinary); }
+static void  del_sem(void *p) { sem_delete(p); }
+static void *new_mtx(void)    { return mtx_create(mtxDefault, 0); }
+static void  del_mtx(void *p) { mtx_delete(p); }
+static void *new_flg(void)    { return flg_create(0); }
+static void  del_flg(void *p) { flg_delete(p); }
+static void *new_msg(void)    { return msg_create(1, SIZE); }
+static void  del_msg(void *p) { msg_delete(p); }
+static void *new_evq(void)    { return evq_create(1); }
+static void  del_evq(void *p) { evq_delete(p); }
+static void *new_tmr(void)    { return tmr_create(NULL); }
+static void  del_tmr(void *p) { tmr_delete(p); }
+
+static void bench(const char *name1, const char *name2, void *(*create)(void), void (*destroy)(void *))
+{
+	int i;
+	void *obj;
+	uint32_t t;
+	bench_stat_t stat_create;
+	bench_stat_t stat_delete;
+
+	bench_stat_init(&stat_create);
+	bench_stat_init(&stat_delete);
+	for (i = 0; i < PASS; i++)
+	{
+		t = bench_clock();
+		obj = create();
+		t = bench_clock() - t;                   ASSERT(obj);
+		bench_stat_add(&stat_create, t);
+		t = bench_clock();
+		destroy(obj);
+		t = bench_clock() - t;
+		bench_stat_add(&stat_delete, t);
+	}
+	bench_stat_report(name1, 0, &stat_create);
+	bench_stat_report(name2, 0, &stat_delete);
+}
+
+void bench_alloc_objects()
+{
+	TEST_Notify();
+	bench("sem_create", "sem_delete", new_sem, del_sem);
+	bench("mtx_create", "mtx_delete", new_mtx, del_mtx);
+	bench("flg_create", "flg_delete", new_flg, del_flg);
+	bench("msg_create", "msg_delete", new_msg, del_msg);
+	bench("evq_create", "evq_delete", new_evq, del_evq);
+	bench("tmr_create", "tmr_delete", new_tmr, del_tmr);
+}
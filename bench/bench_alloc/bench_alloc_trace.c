@@ -0,0 +1,113 @@
+#include "bench.h"
+
+// latency and fragmentation of the system heap under a random size trace (as in test_alloc)
+
+#define SIZE  256
+#define SLOTS  32
+#if     OS_HEAP_SIZE
+#define LIMIT OS_HEAP_SIZE
+#else
+#define LIMIT 65536
+#endif
+
+static void *buf[SLOTS];
+
+static bench_stat_t stat_malloc;
+static bench_stat_t stat_realloc;
+static bench_stat_t stat_free;
+
+static size_t length()
+{
+	return (size_t)rand() % (SIZE) + 1;
+}
+
+static void step()
+{
+	unsigned i = (unsigned)rand() % SLOTS;
+	size_t len;
+	void * ptr;
+	uint32_t t;
+
+	if (buf[i] == NULL)
+	{
+		len = length();
+		t = bench_clock();
+		ptr = malloc(len);
+		t = bench_clock() - t;                   ASSERT(ptr);
+		bench_stat_add(&stat_malloc, t);
+		memset(ptr, 0xFF, len);
+		buf[i] = ptr;
+	}
+	else
+	if (rand() % 2)
+	{
+		len = length();
+		t = bench_clock();
+		ptr = realloc(buf[i], len);
+		t = bench_clock() - t;                   ASSERT(ptr);
+		bench_stat_add(&stat_realloc, t);
+		memset(ptr, 0xFF, len);
+		buf[i] = ptr;
+	}
+	else
+	{
+		t = bench_clock();
+		free(buf[i]);
+		t = bench_clock() - t;
+		bench_stat_add(&stat_free, t);
+		buf[i] = NULL;
+	}
+}
+
+static void largest()
+{
+	size_t lo = 0;
+	size_t hi = LIMIT;
+	size_t len;
+	void * ptr;
+	uint32_t t = 0;
+
+	while (lo < hi)
+	{
+		len = (lo + hi + 1) / 2;
+		ptr = malloc(len);
+		if (ptr == NULL)
+		{
+			hi = len - 1;
+			continue;
+		}
+		free(ptr);
+		lo = len;
+	}
+	if (lo > 0)
+	{
+		t = bench_clock();
+		ptr = malloc(lo);
+		t = bench_clock() - t;                   ASSERT(ptr);
+		free(ptr);
+	}
+	bench_report("malloc:largest_free_block", (unsigned)lo, 1, t);
+}
+
+void bench_alloc_trace()
+{
+	unsigned i;
+
+	TEST_Notify();
+	bench_stat_init(&stat_malloc);
+	bench_stat_init(&stat_realloc);
+	bench_stat_init(&stat_free);
+	srand(0);
+	largest();
+	for (i = 0; i < PASS; i++)
+		step();
+	bench_stat_report("malloc",  SIZE, &stat_malloc);
+	bench_stat_report("realloc", SIZE, &stat_realloc);
+	bench_stat_report("free",    SIZE, &stat_free);
+	largest();
+	for (i = 0; i < SLOTS; i++)
+	{
+		free(buf[i]);
+		buf[i] = NULL;
+	}
+}
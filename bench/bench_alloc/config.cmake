@@ -0,0 +1,8 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_alloc.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_alloc_trace.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_alloc_objects.c
+)
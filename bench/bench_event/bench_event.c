@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_event()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_event_uncontended);
+	BENCH_Add(bench_event_contended);
+}
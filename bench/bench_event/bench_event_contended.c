@@ -0,0 +1,38 @@
+#include "bench.h"
+
+// signal cost of an event a higher-priority task is waiting for
+
+static_EVT(evt3);
+
+static void proc3()
+{
+	int i;
+	int result;
+	unsigned received;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = evt_wait(evt3, &received);       ASSERT_success(result);
+		                                          ASSERT(received == (unsigned)i);
+	}
+	         tsk_stop();
+}
+
+void bench_event_contended()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	TEST_Notify();
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		         evt_give(evt3, (unsigned)i);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report("evt_give/waiting", 0, PASS, t);
+}
@@ -0,0 +1,20 @@
+#include "bench.h"
+
+// signal cost of an event nobody is waiting for
+
+static_EVT(evt3);
+
+void bench_event_uncontended()
+{
+	int i;
+	uint32_t t;
+
+	TEST_Notify();
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		         evt_give(evt3, (unsigned)i);
+	}
+	t = bench_clock() - t;
+	bench_report("evt_give", 0, PASS, t);
+}
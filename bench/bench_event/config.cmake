@@ -0,0 +1,8 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_event.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_event_uncontended.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_event_contended.c
+)
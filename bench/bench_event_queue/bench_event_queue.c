@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_event_queue()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_event_queue_handoff);
+}
@@ -0,0 +1,73 @@
+#include "bench.h"
+
+// transfer cost when the other side is already blocked on the event queue
+
+static_EVQ(evq3, 1);
+
+static void receiver()
+{
+	int i;
+	int result;
+	unsigned event;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = evq_wait(evq3, &event);          ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void sender()
+{
+	int i;
+	int result;
+
+	for (i = 0; i <= PASS; i++)
+	{
+		result = evq_send(evq3, (unsigned)i);     ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void bench_receiver()
+{
+	int i;
+	int result;
+	uint32_t t;
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, receiver);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = evq_give(evq3, (unsigned)i);     ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report("evq_give/receiver_waiting", 0, PASS, t);
+}
+
+static void bench_sender()
+{
+	int i;
+	int result;
+	unsigned event;
+	uint32_t t;
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, sender);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = evq_wait(evq3, &event);          ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = evq_take(evq3, &event);              ASSERT_success(result);
+	bench_report("evq_wait/sender_waiting", 0, PASS, t);
+}
+
+void bench_event_queue_handoff()
+{
+	TEST_Notify();
+	bench_receiver();
+	bench_sender();
+}
@@ -0,0 +1,7 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_event_queue.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_event_queue_handoff.c
+)
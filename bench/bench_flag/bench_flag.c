@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_flag()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_flag_uncontended);
+	BENCH_Add(bench_flag_contended);
+}
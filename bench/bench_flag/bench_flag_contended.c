@@ -0,0 +1,38 @@
+#include "bench.h"
+
+// set cost of a flag a higher-priority task is waiting for
+
+#define FLAG 1U
+
+static_FLG(flg3, 0);
+
+static void proc3()
+{
+	int i;
+	int result;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = flg_wait(flg3, FLAG, flgAll+flgNew); ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+void bench_flag_contended()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	TEST_Notify();
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		         flg_give(flg3, FLAG);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report("flg_give/waiting", 0, PASS, t);
+}
@@ -0,0 +1,24 @@
+#include "bench.h"
+
+// set/consume cost of a flag nobody else is waiting for
+
+#define FLAG 1U
+
+static_FLG(flg3, 0);
+
+void bench_flag_uncontended()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	TEST_Notify();
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		         flg_give(flg3, FLAG);
+		result = flg_take(flg3, FLAG, flgAll);    ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report("flg_give+flg_take", 0, PASS, t);
+}
@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_job_queue()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_job_queue_consumers);
+}
@@ -0,0 +1,77 @@
+#include "bench.h"
+
+// burst throughput of one job queue drained by a number of consumer tasks of equal priority;
+// the queue is filled before the consumers are released, so the producer does not interfere with the drain
+
+#define PRIO      1
+#define CONSUMERS 4
+#define STACK   256
+
+static_JOB(job3, PASS + CONSUMERS);
+
+static tsk_t tsk[CONSUMERS];
+static stk_t stk[CONSUMERS][STACK / sizeof(stk_t)];
+
+static int counter;
+
+static void proc()
+{
+	sys_lock();
+	{
+		counter++;
+	}
+	sys_unlock();
+}
+
+static void quit()
+{
+	tsk_stop();
+}
+
+static void consumer()
+{
+	int result;
+
+	for (;;)
+	{
+		result = job_wait(job3);                  ASSERT_success(result);
+	}
+}
+
+static void bench(unsigned consumers)
+{
+	unsigned i;
+	int result;
+	uint32_t t;
+
+	counter = 0;
+	tsk_prio(PRIO + 1);
+	for (i = 0; i < consumers; i++)
+		tsk_init(&tsk[i], PRIO, consumer, stk[i], sizeof(stk[i]));
+	for (i = 0; i < PASS; i++)
+	{
+		result = job_give(job3, proc);            ASSERT_success(result);
+	}
+	for (i = 0; i < consumers; i++)
+	{
+		result = job_give(job3, quit);            ASSERT_success(result);
+	}
+	t = bench_clock();
+	for (i = 0; i < consumers; i++)
+	{
+		result = tsk_join(&tsk[i]);               ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	tsk_prio(OS_MAIN_PRIO);
+	                                              ASSERT(counter == PASS);
+	bench_report("job_wait/drain", consumers, PASS, t);
+}
+
+void bench_job_queue_consumers()
+{
+	unsigned consumers;
+
+	TEST_Notify();
+	for (consumers = 1; consumers <= CONSUMERS; consumers *= 2)
+		bench(consumers);
+}
@@ -0,0 +1,7 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_job_queue.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_job_queue_consumers.c
+)
@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_mailbox_queue()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_mailbox_queue_handoff);
+}
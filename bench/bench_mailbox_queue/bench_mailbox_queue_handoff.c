@@ -0,0 +1,75 @@
+#include "bench.h"
+
+// transfer cost when the other side is already blocked on the mailbox queue
+
+static_BOX(box3, 1, sizeof(unsigned));
+
+static void receiver()
+{
+	int i;
+	int result;
+	unsigned value;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = box_wait(box3, &value);          ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void sender()
+{
+	int i;
+	int result;
+	unsigned value = 0;
+
+	for (i = 0; i <= PASS; i++)
+	{
+		result = box_send(box3, &value);          ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void bench_receiver()
+{
+	int i;
+	int result;
+	unsigned value = 0;
+	uint32_t t;
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, receiver);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = box_give(box3, &value);          ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report("box_give/receiver_waiting", 0, PASS, t);
+}
+
+static void bench_sender()
+{
+	int i;
+	int result;
+	unsigned value;
+	uint32_t t;
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, sender);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = box_wait(box3, &value);          ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = box_take(box3, &value);              ASSERT_success(result);
+	bench_report("box_wait/sender_waiting", 0, PASS, t);
+}
+
+void bench_mailbox_queue_handoff()
+{
+	TEST_Notify();
+	bench_receiver();
+	bench_sender();
+}
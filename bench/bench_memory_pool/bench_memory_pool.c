@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_memory_pool()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_memory_pool_isr);
+}
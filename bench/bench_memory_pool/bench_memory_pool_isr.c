@@ -0,0 +1,92 @@
+#include "bench.h"
+
+// memory pool throughput of a task while a periodic interrupt allocates from the same pool;
+// the interrupt comes from the TIM7 basic timer, at a rate high enough for the load to show in the task throughput
+
+#define LIMIT 16
+#define SIZE  32
+#define LOAD   8
+#define LOOP  (PASS*10)
+#define RATE  20000 // Hz
+
+static_MEM(mem3, LIMIT, SIZE);
+
+static unsigned     load;
+static bench_stat_t stat_isr;
+
+void TIM7_IRQHandler(void)
+{
+	unsigned i;
+	int result;
+	void *p[LOAD];
+	uint32_t t;
+
+	TIM7->SR = 0;
+
+	t = bench_clock();
+	for (i = 0; i < load; i++)
+	{
+		result = mem_take(mem3, &p[i]);           ASSERT_success(result);
+	}
+	for (i = 0; i < load; i++)
+	{
+		         mem_give(mem3, p[i]);
+	}
+	t = bench_clock() - t;
+	bench_stat_add(&stat_isr, t);
+}
+
+static void isr_start()
+{
+	RCC->APB1ENR |= RCC_APB1ENR_TIM7EN;
+	TIM7->PSC  = 0;
+	TIM7->ARR  = CPU_FREQUENCY / 2 / RATE - 1; // APB1 timer clock is half the core clock
+	TIM7->EGR  = TIM_EGR_UG;
+	TIM7->SR   = 0;
+	TIM7->DIER = TIM_DIER_UIE;
+	NVIC_SetPriority(TIM7_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+	NVIC_EnableIRQ(TIM7_IRQn);
+	TIM7->CR1  = TIM_CR1_CEN;
+}
+
+static void isr_stop()
+{
+	TIM7->CR1  = 0;
+	NVIC_DisableIRQ(TIM7_IRQn);
+	TIM7->SR   = 0;
+	NVIC_ClearPendingIRQ(TIM7_IRQn);
+	RCC->APB1ENR &= ~RCC_APB1ENR_TIM7EN;
+}
+
+static void bench(unsigned n)
+{
+	int i;
+	int result;
+	void *p;
+	uint32_t t;
+
+	load = n;
+	bench_stat_init(&stat_isr);
+	if (load > 0)
+		isr_start();
+	t = bench_clock();
+	for (i = 0; i < LOOP; i++)
+	{
+		result = mem_wait(mem3, &p);              ASSERT_success(result);
+		         mem_give(mem3, p);
+	}
+	t = bench_clock() - t;
+	if (load > 0)
+		isr_stop();
+	bench_report("mem_wait+mem_give", load, LOOP, t);
+	bench_stat_report("mem_take+mem_give/isr", load, &stat_isr);
+}
+
+void bench_memory_pool_isr()
+{
+	unsigned n;
+
+	TEST_Notify();
+	for (n = 0; n <= LOAD; n += LOAD / 2)
+		bench(n);
+}
@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_message_queue()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_message_queue_copy);
+	BENCH_Add(bench_message_queue_handoff);
+}
@@ -0,0 +1,45 @@
+#include "bench.h"
+
+// send/receive cost of a message queue as a function of the frame size
+
+#define SIZE 4096
+
+static_MSG(msg3, 1, SIZE);
+
+static char sent[SIZE];
+static char received[SIZE];
+
+static void bench(unsigned size)
+{
+	int i;
+	int result;
+	unsigned read;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+		memcpy(received, sent, size);
+	t = bench_clock() - t;
+	bench_report("memcpy", size, PASS, t);
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = msg_give(msg3, sent, size);      ASSERT_success(result);
+		result = msg_wait(msg3, received, SIZE, &read);
+		                                          ASSERT_success(result);
+		                                          ASSERT(read == size);
+	}
+	t = bench_clock() - t;
+	bench_report("msg_give+msg_wait", size, PASS, t);
+}
+
+void bench_message_queue_copy()
+{
+	unsigned size;
+
+	TEST_Notify();
+	memset(sent, 0xFF, SIZE);
+	for (size = 16; size <= SIZE; size *= 4)
+		bench(size);
+}
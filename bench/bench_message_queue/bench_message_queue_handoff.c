@@ -0,0 +1,79 @@
+#include "bench.h"
+
+// transfer cost when the other side is already blocked on the message queue
+
+#define SIZE sizeof(unsigned)
+
+static_MSG(msg3, 1, SIZE);
+
+static void receiver()
+{
+	int i;
+	int result;
+	unsigned value;
+	unsigned read;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void sender()
+{
+	int i;
+	int result;
+	unsigned value = 0;
+
+	for (i = 0; i <= PASS; i++)
+	{
+		result = msg_send(msg3, &value, SIZE);    ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void bench_receiver()
+{
+	int i;
+	int result;
+	unsigned value = 0;
+	uint32_t t;
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, receiver);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = msg_give(msg3, &value, SIZE);    ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report("msg_give/receiver_waiting", 0, PASS, t);
+}
+
+static void bench_sender()
+{
+	int i;
+	int result;
+	unsigned value;
+	unsigned read;
+	uint32_t t;
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, sender);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = msg_take(msg3, &value, SIZE, &read); ASSERT_success(result);
+	bench_report("msg_wait/sender_waiting", 0, PASS, t);
+}
+
+void bench_message_queue_handoff()
+{
+	TEST_Notify();
+	bench_receiver();
+	bench_sender();
+}
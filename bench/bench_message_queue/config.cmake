@@ -0,0 +1,8 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_message_queue.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_message_queue_copy.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_message_queue_handoff.c
+)
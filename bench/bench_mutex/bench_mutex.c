@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_mutex()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_mutex_uncontended);
+	BENCH_Add(bench_mutex_contended);
+}
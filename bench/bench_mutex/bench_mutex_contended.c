@@ -0,0 +1,48 @@
+#include "bench.h"
+
+// hand-over cost of a mutex a higher-priority task is waiting for
+
+static_MTX(mtx3, mtxDefault);
+static_SEM(sem3, 0, semBinary);
+
+static void proc3()
+{
+	int i;
+	int result;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = sem_wait(sem3);                  ASSERT_success(result);
+		result = mtx_wait(mtx3);                  ASSERT_success(result);
+		result = mtx_give(mtx3);                  ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void bench(const char *name, unsigned mode)
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	mtx_init(mtx3, mode, 0);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = mtx_wait(mtx3);                  ASSERT_success(result);
+		result = sem_give(sem3);                  ASSERT_success(result);
+		result = mtx_give(mtx3);                  ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report(name, mode, PASS, t);
+}
+
+void bench_mutex_contended()
+{
+	TEST_Notify();
+	bench("mtx_wait+sem_give+mtx_give/waiting:normal",      mtxNormal);
+	bench("mtx_wait+sem_give+mtx_give/waiting:prioinherit", mtxPrioInherit);
+}
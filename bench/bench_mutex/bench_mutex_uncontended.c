@@ -0,0 +1,32 @@
+#include "bench.h"
+
+// acquire/release cost of a mutex nobody else is waiting for
+
+static_MTX(mtx3, mtxDefault);
+
+static void bench(const char *name, unsigned mode)
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	mtx_init(mtx3, mode, 0);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = mtx_wait(mtx3);                  ASSERT_success(result);
+		result = mtx_give(mtx3);                  ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report(name, mode, PASS, t);
+}
+
+void bench_mutex_uncontended()
+{
+	TEST_Notify();
+	bench("mtx_wait+mtx_give:normal",       mtxNormal);
+	bench("mtx_wait+mtx_give:errorcheck",   mtxErrorCheck);
+	bench("mtx_wait+mtx_give:recursive",    mtxRecursive);
+	bench("mtx_wait+mtx_give:prioinherit",  mtxPrioInherit);
+	bench("mtx_wait+mtx_give:robust",       mtxNormal + mtxRobust);
+}
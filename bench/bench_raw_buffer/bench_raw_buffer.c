@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_raw_buffer()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_raw_buffer_copy);
+}
@@ -0,0 +1,39 @@
+#include "bench.h"
+
+// send/receive cost of a raw buffer as a function of the frame size
+
+#define SIZE 4096
+
+static_RAW(raw3, SIZE * 2);
+
+static char sent[SIZE];
+static char received[SIZE];
+
+static void bench(unsigned size)
+{
+	int i;
+	int result;
+	unsigned read;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = raw_give(raw3, sent, size);      ASSERT_success(result);
+		result = raw_wait(raw3, received, size, &read);
+		                                          ASSERT_success(result);
+		                                          ASSERT(read == size);
+	}
+	t = bench_clock() - t;
+	bench_report("raw_give+raw_wait", size, PASS, t);
+}
+
+void bench_raw_buffer_copy()
+{
+	unsigned size;
+
+	TEST_Notify();
+	memset(sent, 0xFF, SIZE);
+	for (size = 16; size <= SIZE; size *= 4)
+		bench(size);
+}
@@ -0,0 +1,12 @@
+#include "bench.h"
+
+void bench_rhealstone()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_rhealstone_task_switch);
+	BENCH_Add(bench_rhealstone_preemption);
+	BENCH_Add(bench_rhealstone_interrupt);
+	BENCH_Add(bench_rhealstone_semaphore_shuffle);
+	BENCH_Add(bench_rhealstone_deadlock_break);
+	BENCH_Add(bench_rhealstone_message);
+}
@@ -0,0 +1,56 @@
+#include "bench.h"
+
+// rhealstone: deadlock-break time, from a high-priority task blocking on a priority-inheritance mutex held by a low-priority task
+// (with a medium-priority task ready to run) to the high-priority task taking ownership of the mutex
+
+static bench_stat_t stat;
+
+static void proc3()
+{
+	int result;
+	uint32_t t;
+
+	t = bench_clock();
+	result = mtx_wait(&mtx0);                     ASSERT_success(result);
+	         bench_stat_add(&stat, bench_clock() - t);
+	result = mtx_give(&mtx0);                     ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void proc2()
+{
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	result = mtx_wait(&mtx0);                     ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	result = mtx_give(&mtx0);                     ASSERT_success(result);
+	         tsk_stop();
+}
+
+void bench_rhealstone_deadlock_break()
+{
+	int i;
+	int result;
+
+	TEST_Notify();
+	         bench_stat_init(&stat);
+	         mtx_init(&mtx0, mtxPrioInherit, 0);
+	for (i = 0; i < PASS; i++)
+	{
+		                                          ASSERT_dead(tsk1);
+		     tsk_startFrom(tsk1, proc1);
+		result = tsk_join(tsk1);                  ASSERT_success(result);
+		result = tsk_join(tsk2);                  ASSERT_success(result);
+		result = tsk_join(tsk3);                  ASSERT_success(result);
+	}
+	         mtx_init(&mtx0, mtxDefault, 0);
+	         bench_stat_report("rhealstone:deadlock_break", 0, &stat);
+}
@@ -0,0 +1,35 @@
+#include "bench.h"
+
+// rhealstone: interrupt latency, from setting a spare interrupt pending to the first line of its handler;
+// HASH_RNG is unused (no HASH unit on the STM32F407, RNG disabled) and its handler makes no kernel calls
+
+static bench_stat_t stat;
+static volatile uint32_t stamp;
+
+void HASH_RNG_IRQHandler(void)
+{
+	uint32_t t = bench_clock();
+
+	bench_stat_add(&stat, t - stamp);
+}
+
+void bench_rhealstone_interrupt()
+{
+	int i;
+
+	TEST_Notify();
+	bench_stat_init(&stat);
+	NVIC_SetPriority(HASH_RNG_IRQn, 0);
+	NVIC_ClearPendingIRQ(HASH_RNG_IRQn);
+	NVIC_EnableIRQ(HASH_RNG_IRQn);
+	for (i = 0; i < PASS; i++)
+	{
+		stamp = bench_clock();
+		NVIC_SetPendingIRQ(HASH_RNG_IRQn);
+		__DSB();
+		__ISB();
+	}
+	NVIC_DisableIRQ(HASH_RNG_IRQn);
+	                                              ASSERT(stat.count == PASS);
+	bench_stat_report("rhealstone:interrupt_latency", 0, &stat);
+}
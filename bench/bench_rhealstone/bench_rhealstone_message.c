@@ -0,0 +1,39 @@
+#include "bench.h"
+
+// rhealstone: intertask message latency, from sending a message to the resumption of the higher-priority task waiting for it
+
+static bench_stat_t stat;
+
+static void proc3()
+{
+	int i;
+	int result;
+	unsigned stamp;
+	unsigned read;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = msg_wait(&msg0, &stamp, sizeof(stamp), &read); ASSERT_success(result);
+		         bench_stat_add(&stat, bench_clock() - stamp);
+	}
+	         tsk_stop();
+}
+
+void bench_rhealstone_message()
+{
+	int i;
+	int result;
+	unsigned stamp;
+
+	TEST_Notify();
+	         bench_stat_init(&stat);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	for (i = 0; i < PASS; i++)
+	{
+		stamp = bench_clock();
+		result = msg_give(&msg0, &stamp, sizeof(stamp)); ASSERT_success(result);
+	}
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	         bench_stat_report("rhealstone:message_latency", 0, &stat);
+}
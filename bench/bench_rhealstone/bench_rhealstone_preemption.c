@@ -0,0 +1,44 @@
+#include "bench.h"
+
+// rhealstone: preemption time of a low-priority task by a higher-priority task woken up by the system tick
+
+static bench_stat_t stat;
+static volatile uint32_t stamp;
+static volatile bool done;
+
+static void proc1()
+{
+	while (!done)
+		stamp = bench_clock();
+	         tsk_stop();
+}
+
+static void proc2()
+{
+	int i;
+
+	for (i = 0; i < PASS; i++)
+	{
+		         tsk_delay(1);
+		         bench_stat_add(&stat, bench_clock() - stamp);
+	}
+	done = true;
+	         tsk_stop();
+}
+
+void bench_rhealstone_preemption()
+{
+	int result;
+
+	TEST_Notify();
+	         bench_stat_init(&stat);
+	done = false;
+	stamp = bench_clock();
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	         bench_stat_report("rhealstone:preemption", 0, &stat);
+}
@@ -0,0 +1,52 @@
+#include "bench.h"
+
+// rhealstone: semaphore shuffle time, from the release of a semaphore to the resumption of the task of equal priority waiting for it
+
+static bench_stat_t stat;
+static volatile uint32_t stamp;
+
+static void proc2()
+{
+	int i;
+	int result;
+
+	         tsk_prio(2);
+	for (i = 0; i < PASS; i++)
+	{
+		result = sem_wait(&sem0);                 ASSERT_success(result);
+		         bench_stat_add(&stat, bench_clock() - stamp);
+	}
+	         tsk_stop();
+}
+
+static void proc3()
+{
+	int i;
+	int result;
+
+	         tsk_prio(2);
+	for (i = 0; i < PASS; i++)
+	{
+		         tsk_yield();
+		stamp = bench_clock();
+		result = sem_give(&sem0);                 ASSERT_success(result);
+	}
+	         tsk_prio(3);
+	         tsk_stop();
+}
+
+void bench_rhealstone_semaphore_shuffle()
+{
+	int result;
+
+	TEST_Notify();
+	         bench_stat_init(&stat);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = sem_take(&sem0);                     ASSERT_timeout(result);
+	         bench_stat_report("rhealstone:semaphore_shuffle", 0, &stat);
+}
@@ -0,0 +1,52 @@
+#include "bench.h"
+
+// rhealstone: task switch time between two tasks of equal priority
+
+static bench_stat_t stat;
+static volatile uint32_t stamp;
+
+static void proc()
+{
+	int i;
+	uint32_t t;
+
+	         tsk_prio(2);
+	for (i = 0; i < PASS; i++)
+	{
+		stamp = t = bench_clock();
+		         tsk_yield();
+		if (stamp != t) // skipped when the other task has already stopped
+		         bench_stat_add(&stat, bench_clock() - stamp);
+	}
+}
+
+static void proc2()
+{
+	         proc();
+	         tsk_prio(2);
+	         tsk_stop();
+}
+
+static void proc3()
+{
+	         proc();
+	         tsk_prio(3);
+	         tsk_stop();
+}
+
+void bench_rhealstone_task_switch()
+{
+	int result;
+
+	TEST_Notify();
+	         bench_stat_init(&stat);
+	         sys_lock();
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	         sys_unlock();
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	         bench_stat_report("rhealstone:task_switch", 0, &stat);
+}
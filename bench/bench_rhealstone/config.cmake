@@ -0,0 +1,12 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone_task_switch.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone_preemption.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone_interrupt.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone_semaphore_shuffle.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone_deadlock_break.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone_message.c
+)
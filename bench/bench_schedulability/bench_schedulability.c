@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_schedulability()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_schedulability_fixed_priority);
+}
@@ -0,0 +1,97 @@
+#include "bench.h"
+
+// response times of a rate-monotonic set of periodic tasks released by tsk_sleepNext,
+// with deadlines equal to the periods, for increasing total utilisation;
+// "fp:deadline_miss" is reported only for the utilisation levels where a deadline was missed
+
+#define TASKS 3
+#define TICK  (CPU_FREQUENCY / OS_FREQUENCY)
+#define LOOP  100000
+
+static const cnt_t period[TASKS] = { 11, 7, 5 }; // tsk1 (lowest priority) .. tsk3 (highest priority)
+
+static unsigned     work[TASKS];
+static cnt_t        start;
+static bench_stat_t response;
+static bench_stat_t miss;
+
+static void spin(unsigned n)
+{
+	volatile unsigned i;
+
+	for (i = 0; i < n; i++);
+}
+
+// cycles elapsed since the start of the release tick
+static uint32_t since(cnt_t release)
+{
+	cnt_t    cnt;
+	uint32_t val;
+
+	do { cnt = sys_time(); val = SysTick->VAL; } while (cnt != sys_time());
+	return (uint32_t)(cnt - release) * (SysTick->LOAD + 1) + SysTick->LOAD - val;
+}
+
+static void job(unsigned k)
+{
+	cnt_t release;
+	uint32_t t;
+
+	         tsk_prio(k + 1); // rate-monotonic priority, the base priority of tsk1..tsk3
+	         tsk_sleepUntil(start);
+	for (release = start; release - start < PASS; release += period[k])
+	{
+		         spin(work[k]);
+		t = since(release);
+		         sys_lock();
+		         bench_stat_add(&response, t);
+		if (t > period[k] * TICK)
+		{
+		         bench_stat_add(&miss, t - period[k] * TICK);
+		}
+		         sys_unlock();
+		         tsk_sleepNext(period[k]);
+	}
+	         tsk_stop();
+}
+
+static void proc1() { job(0); }
+static void proc2() { job(1); }
+static void proc3() { job(2); }
+
+static void bench(unsigned utilisation, uint32_t rate)
+{
+	unsigned k;
+	int result;
+
+	for (k = 0; k < TASKS; k++)
+		work[k] = (unsigned)((uint64_t)period[k] * TICK * utilisation / TASKS / 100 * LOOP / rate);
+	bench_stat_init(&response);
+	bench_stat_init(&miss);
+	start = sys_time() + 1;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	bench_stat_report("fp:response", utilisation, &response);
+	bench_stat_report("fp:deadline_miss", utilisation, &miss);
+}
+
+void bench_schedulability_fixed_priority()
+{
+	unsigned u;
+	uint32_t rate;
+
+	TEST_Notify();
+	rate = bench_clock();
+	spin(LOOP);
+	rate = bench_clock() - rate; // cycles per LOOP iterations of spin
+	ASSERT(rate > 0);
+	for (u = 50; u <= 100; u += 10)
+		bench(u, rate);
+}
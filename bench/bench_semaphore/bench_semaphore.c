@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_semaphore()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_semaphore_uncontended);
+	BENCH_Add(bench_semaphore_contended);
+}
@@ -0,0 +1,36 @@
+#include "bench.h"
+
+// release cost of a semaphore a higher-priority task is waiting for
+
+static_SEM(sem3, 0, semCounting);
+
+static void proc3()
+{
+	int i;
+	int result;
+
+	for (i = 0; i < PASS; i++)
+	{
+		result = sem_wait(sem3);                  ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+void bench_semaphore_contended()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	TEST_Notify();
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = sem_give(sem3);                  ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	bench_report("sem_give/waiting", 0, PASS, t);
+}
@@ -0,0 +1,44 @@
+#include "bench.h"
+
+// acquire/release cost of a semaphore nobody else is waiting for
+
+static_SEM(sem3, 0, semCounting);
+
+static void bench_take()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = sem_give(sem3);                  ASSERT_success(result);
+		result = sem_take(sem3);                  ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report("sem_give+sem_take", 0, PASS, t);
+}
+
+static void bench_wait()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		result = sem_give(sem3);                  ASSERT_success(result);
+		result = sem_wait(sem3);                  ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report("sem_give+sem_wait", 0, PASS, t);
+}
+
+void bench_semaphore_uncontended()
+{
+	TEST_Notify();
+	bench_take();
+	bench_wait();
+}
@@ -0,0 +1,7 @@
+#include "bench.h"
+
+void bench_state_machine()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_state_machine_dispatch);
+}
@@ -0,0 +1,56 @@
+#include "bench.h"
+
+// event delivery and handler dispatch cost of a state machine served by a higher-priority dispatcher task
+
+#define PRIO 3
+
+enum
+{
+	EventTick = hsmUser,
+};
+
+static hsm_state_t  state3;
+static hsm_t        hsm3;
+static unsigned     hsm3_queue[1];
+static tsk_t        dispatcher;
+static stk_t        dispatcher_stack[256 / sizeof(stk_t)];
+
+static unsigned counter;
+
+static void handler(hsm_t *hsm, unsigned event)
+{
+	(void) hsm;
+	(void) event;
+
+	counter++;
+}
+
+static hsm_action_t tab[] =
+{
+	HSM_ACTION_INIT(&state3, EventTick, NULL, handler),
+};
+
+void bench_state_machine_dispatch()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	TEST_Notify();
+	hsm_initState(&state3, NULL);
+	hsm_init(&hsm3, hsm3_queue, sizeof(hsm3_queue));
+	wrk_init(&dispatcher, PRIO, NULL, dispatcher_stack, sizeof(dispatcher_stack));
+	hsm_link(&tab[0]);
+	hsm_start(&hsm3, &dispatcher, &state3);
+	counter = 0;
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		         hsm_send(&hsm3, EventTick);
+	}
+	t = bench_clock() - t;
+	                                              ASSERT(counter == PASS);
+	         hsm_send(&hsm3, hsmStop);
+	result = tsk_join(&dispatcher);               ASSERT_success(result);
+	bench_report("hsm_send/dispatch", 0, PASS, t);
+}
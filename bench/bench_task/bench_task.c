@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_task()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_task_switch);
+	BENCH_Add(bench_task_create);
+}
@@ -0,0 +1,73 @@
+#include "bench.h"
+
+// task create/destroy cycle with and without heap allocation of the control block and stack
+
+#define PRIO   3
+#define STACK 256
+
+static tsk_t tsk8;
+static stk_t stk8[STACK / sizeof(stk_t)];
+
+static void proc()
+{
+	         tsk_stop();
+}
+
+static void bench_init()
+{
+	int i;
+	int result;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		         tsk_init(&tsk8, PRIO, proc, stk8, sizeof(stk8));
+		result = tsk_join(&tsk8);                 ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report("tsk_init+tsk_join", STACK, PASS, t);
+}
+
+static void bench_create()
+{
+	int i;
+	int result;
+	tsk_t *tsk;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		tsk    = tsk_create(PRIO, proc);          ASSERT(tsk);
+		result = tsk_join(tsk);                   ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report("tsk_create+tsk_join", OS_STACK_SIZE, PASS, t);
+}
+
+static void bench_wrk_create()
+{
+	int i;
+	int result;
+	tsk_t *tsk;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		tsk    = wrk_create(PRIO, proc, STACK, false, true);
+		                                          ASSERT(tsk);
+		result = tsk_join(tsk);                   ASSERT_success(result);
+	}
+	t = bench_clock() - t;
+	bench_report("wrk_create+tsk_join", STACK, PASS, t);
+}
+
+void bench_task_create()
+{
+	TEST_Notify();
+	bench_init();
+	bench_create();
+	bench_wrk_create();
+}
@@ -0,0 +1,61 @@
+#include "bench.h"
+
+// context switch cost as a function of the number of ready tasks at the same priority
+
+#define PRIO   2
+#define TASKS 64
+#define STACK 256
+
+static tsk_t tsk[TASKS];
+static stk_t stk[TASKS][STACK / sizeof(stk_t)];
+
+static volatile bool done;
+static uint32_t      time;
+
+static void proc()
+{
+	while (!done)
+		tsk_yield();
+	tsk_stop();
+}
+
+static void meter()
+{
+	int i;
+	uint32_t t;
+
+	tsk_yield();
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+		tsk_yield();
+	time = bench_clock() - t;
+	done = true;
+	tsk_stop();
+}
+
+static void bench(unsigned ready)
+{
+	unsigned i;
+	int result;
+
+	done = false;
+	tsk_prio(PRIO + 1);
+	for (i = 1; i < ready; i++)
+		tsk_init(&tsk[i], PRIO, proc, stk[i], sizeof(stk[i]));
+	tsk_init(&tsk[0], PRIO, meter, stk[0], sizeof(stk[0]));
+	for (i = 0; i < ready; i++)
+	{
+		result = tsk_join(&tsk[i]);               ASSERT_success(result);
+	}
+	tsk_prio(OS_MAIN_PRIO);
+	bench_report("tsk_yield", ready, PASS * ready, time);
+}
+
+void bench_task_switch()
+{
+	unsigned ready;
+
+	TEST_Notify();
+	for (ready = 1; ready <= TASKS; ready *= 2)
+		bench(ready);
+}
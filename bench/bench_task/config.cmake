@@ -0,0 +1,8 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_task.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_task_switch.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_task_create.c
+)
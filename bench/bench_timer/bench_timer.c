@@ -0,0 +1,8 @@
+#include "bench.h"
+
+void bench_timer()
+{
+	UNIT_Notify();
+	BENCH_Add(bench_timer_start);
+	BENCH_Add(bench_timer_callback);
+}
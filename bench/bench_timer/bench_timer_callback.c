@@ -0,0 +1,26 @@
+#include "bench.h"
+
+// time from the SysTick reload to the timer procedure called from the tick handler,
+// including the kernel tick and timer list processing
+
+static tmr_t tmr3;
+
+static bench_stat_t stat;
+
+static void isr()
+{
+	if (stat.count < PASS)
+		bench_stat_add(&stat, SysTick->LOAD - SysTick->VAL);
+}
+
+void bench_timer_callback()
+{
+	TEST_Notify();
+	bench_stat_init(&stat);
+	tmr_init(&tmr3, NULL);
+	tmr_startFrom(&tmr3, 1, 1, isr);
+	while (stat.count < PASS)
+		tsk_delay(PASS);
+	tmr_kill(&tmr3);
+	bench_stat_report("tick_to_timer_callback", 0, &stat);
+}
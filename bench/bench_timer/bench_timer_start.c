@@ -0,0 +1,54 @@
+#include "bench.h"
+
+// timer arm and cancel cost as a function of the number of pending timers
+
+#define TIMERS 1000
+#define DELAY  (60*SEC)
+
+static tmr_t tmr[TIMERS];
+static tmr_t tmr3;
+
+static cnt_t delay(unsigned i)
+{
+	return DELAY + (i * 7919U) % DELAY;
+}
+
+static void bench(unsigned pending)
+{
+	unsigned i;
+	uint32_t t;
+
+	t = bench_clock();
+	for (i = 0; i < pending; i++)
+		tmr_start(&tmr[i], delay(i), 0);
+	t = bench_clock() - t;
+	bench_report("tmr_start", pending, pending, t);
+
+	t = bench_clock();
+	for (i = 0; i < PASS; i++)
+	{
+		tmr_start(&tmr3, delay(i), 0);
+		tmr_kill(&tmr3);
+	}
+	t = bench_clock() - t;
+	bench_report("tmr_start+tmr_kill", pending, PASS, t);
+
+	t = bench_clock();
+	for (i = 0; i < pending; i++)
+		tmr_kill(&tmr[i]);
+	t = bench_clock() - t;
+	bench_report("tmr_kill", pending, pending, t);
+}
+
+void bench_timer_start()
+{
+	unsigned i;
+	unsigned pending;
+
+	TEST_Notify();
+	tmr_init(&tmr3, NULL);
+	for (i = 0; i < TIMERS; i++)
+		tmr_init(&tmr[i], NULL);
+	for (pending = 10; pending <= TIMERS; pending *= 10)
+		bench(pending);
+}
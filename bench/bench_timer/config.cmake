@@ -0,0 +1,8 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_timer.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_timer_start.c
+	${CMAKE_CURRENT_LIST_DIR}/bench_timer_callback.c
+)
@@ -0,0 +1,18 @@
+include_guard(GLOBAL)
+
+include(${CMAKE_CURRENT_LIST_DIR}/bench_alloc/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_event/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_event_queue/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_flag/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_job_queue/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_mailbox_queue/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_memory_pool/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_message_queue/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_mutex/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_raw_buffer/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_rhealstone/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_schedulability/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_semaphore/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_state_machine/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_task/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/bench_timer/config.cmake)
@@ -0,0 +1,36 @@
+#include "test.h"
+
+#pragma once
+
+typedef struct
+{
+	unsigned count;
+	uint32_t min;
+	uint32_t max;
+	uint32_t sum;
+}	bench_stat_t;
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+void     bench_add   (fun_t *fun);
+uint32_t bench_clock (void);
+void     bench_report(const char *name, unsigned param, unsigned loops, uint32_t cycles);
+
+void     bench_stat_init  (bench_stat_t *stat);
+void     bench_stat_add   (bench_stat_t *stat, uint32_t cycles);
+void     bench_stat_report(const char *name, unsigned param, bench_stat_t *stat);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#define BENCH_Add(fun)         do { void fun (void); bench_add(fun); } while (0)
+#define BENCH_AddUnit(unit)    do { void unit(void); unit();         } while (0)
+
+// stdout carries the records only
+#undef  UNIT_Notify
+#undef  TEST_Notify
+#define UNIT_Notify()          do { LED_Tick(); } while (0)
+#define TEST_Notify()          do { LED_Tick(); } while (0)
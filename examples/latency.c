@@ -0,0 +1,152 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+#include <stdio.h>
+
+// wake-up latency from a timer callback (interrupt context) to the first dispatch of the woken task,
+// and latency from the timer expiry (the SysTick reload of the expiry tick) to its callback,
+// collected into log2 histograms of cpu cycles
+
+#define PERIOD (10*MSEC)
+#define BINS   33
+
+typedef struct
+{
+	unsigned count;
+	uint32_t max;
+	unsigned bin[BINS];
+}	hist_t;
+
+hist_t hist_sem;
+hist_t hist_job;
+hist_t hist_raw;
+hist_t hist_tmr;
+
+volatile uint32_t sem_stamp;
+volatile uint32_t job_stamp;
+
+bool cyccnt = false;
+
+uint32_t stamp()
+{
+	cnt_t cnt;
+	uint32_t val;
+
+	if (cyccnt)
+		return DWT->CYCCNT;
+
+	// qemu does not emulate the cycle counter, use the system tick and the SysTick counter instead
+	do
+	{
+		cnt = sys_time();
+		val = SysTick->VAL;
+	}
+	while (cnt != sys_time());
+
+	return (uint32_t)cnt * (SysTick->LOAD + 1) + SysTick->LOAD - val;
+}
+
+void hist_add(hist_t *hist, uint32_t delta)
+{
+	hist->count++;
+	hist->bin[delta ? 32 - __CLZ(delta) : 0]++;
+	if (hist->max < delta)
+		hist->max = delta;
+}
+
+void hist_print(const char *name, hist_t *hist)
+{
+	hist_t h;
+
+	sys_lock();
+	{
+		h = *hist;
+	}
+	sys_unlock();
+
+	printf("%s: count %u, max %lu;", name, h.count, (unsigned long)h.max);
+	for (int i = 0; i < BINS; i++)
+		if (h.bin[i])
+			printf(" <2^%d:%u", i, h.bin[i]);
+	printf("\n");
+}
+
+OS_SEM(sem, 0, semBinary);
+OS_JOB(job, 1);
+OS_RAW(raw, sizeof(uint32_t));
+
+void measure()
+{
+	hist_add(&hist_job, stamp() - job_stamp);
+}
+
+OS_TSK_START(sem_cons, 3)
+{
+	for (;;)
+	{
+		sem_wait(sem);
+		hist_add(&hist_sem, stamp() - sem_stamp);
+	}
+}
+
+OS_TSK_START(job_cons, 3)
+{
+	for (;;)
+	{
+		job_wait(job);
+	}
+}
+
+OS_TSK_START(raw_cons, 3)
+{
+	uint32_t t;
+
+	for (;;)
+	{
+		raw_wait(raw, &t, sizeof(t), NULL);
+		hist_add(&hist_raw, stamp() - t);
+	}
+}
+
+OS_TMR_START(tmr, PERIOD, PERIOD)
+{
+	static unsigned next = 0;
+	uint32_t t;
+
+	hist_add(&hist_tmr, SysTick->LOAD - SysTick->VAL);
+
+	switch (next++ % 3)
+	{
+	case 0:
+		sem_stamp = stamp();
+		sem_giveISR(sem);
+		break;
+	case 1:
+		job_stamp = stamp();
+		job_giveISR(job, measure);
+		break;
+	default:
+		t = stamp();
+		raw_give(raw, &t, sizeof(t));
+		break;
+	}
+}
+
+int main()
+{
+	LED_Init();
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	cyccnt = DWT->CYCCNT != DWT->CYCCNT;
+
+	for (;;)
+	{
+		tsk_delay(SEC);
+		hist_print("sem_giveISR", &hist_sem);
+		hist_print("job_giveISR", &hist_job);
+		hist_print("raw_give",    &hist_raw);
+		hist_print("tmr expiry",  &hist_tmr);
+		LED_Tick();
+	}
+}
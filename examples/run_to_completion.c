@@ -0,0 +1,83 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+
+// run-to-completion tasks: activated by the timer, they run and return without blocking,
+// so all tasks of one preemption level share the stack of a single worker
+
+#define COUNT 40
+
+typedef struct rtc rtc_t;
+
+struct rtc
+{
+	void  (*proc)(rtc_t *);
+	evq_t  *level;
+	cnt_t   period;
+	cnt_t   delay;
+	unsigned state;
+};
+
+static rtc_t rtc[COUNT];
+
+OS_EVQ(hi, COUNT);
+OS_EVQ(lo, COUNT);
+
+static void blink(rtc_t *t)
+{
+	t->state++;
+	LED_Tick();
+}
+
+static void count(rtc_t *t)
+{
+	t->state++;
+}
+
+static void dispatch(evq_t *evq)
+{
+	unsigned i;
+
+	for (;;)
+	{
+		evq_wait(evq, &i);
+		rtc[i].proc(&rtc[i]);
+	}
+}
+
+OS_TSK_START(hi_worker, 2)
+{
+	dispatch(hi);
+}
+
+OS_TSK_START(lo_worker, 1)
+{
+	dispatch(lo);
+}
+
+OS_TMR_START(tmr, 1, 1)
+{
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		if (rtc[i].proc == NULL || --rtc[i].delay > 0)
+			continue;
+		rtc[i].delay = rtc[i].period;
+		evq_giveISR(rtc[i].level, i);
+	}
+}
+
+int main()
+{
+	unsigned i;
+
+	LED_Init();
+
+	sys_lock();
+	for (i = 1; i < COUNT; i++)
+		rtc[i] = (rtc_t){ count, i < COUNT / 4 ? hi : lo, i, i, 0 };
+	rtc[0] = (rtc_t){ blink, hi, SEC, SEC, 0 };
+	sys_unlock();
+
+	tsk_sleep();
+}
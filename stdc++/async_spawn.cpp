@@ -0,0 +1,57 @@
+#include "stm32f4_discovery.h"
+#include <thread>
+#include <future>
+#include <chrono>
+#include <cstdio>
+
+using namespace std::chrono;
+
+constexpr int count = 1000;
+
+template <typename F>
+void measure(const char *name, F spawn)
+{
+	auto t = steady_clock::now();
+	for (int i = 0; i < count; i++)
+		spawn(i);
+	auto d = duration_cast<nanoseconds>(steady_clock::now() - t);
+	std::printf("%s,%d,%lu\n", name, count, static_cast<unsigned long>(d.count() / count));
+}
+
+void test()
+{
+	measure("async(launch::async)", [](int i)
+	{
+		if (std::async(std::launch::async, [](int v){ return v + 1; }, i).get() != i + 1) abort();
+	});
+	measure("async(launch::deferred)", [](int i)
+	{
+		if (std::async(std::launch::deferred, [](int v){ return v + 1; }, i).get() != i + 1) abort();
+	});
+	measure("thread", [](int i)
+	{
+		int v = 0;
+		std::thread([&]{ v = i + 1; }).join();
+		if (v != i + 1) abort();
+	});
+	measure("packaged_task+thread", [](int i)
+	{
+		std::packaged_task<int(int)> task([](int v){ return v + 1; });
+		auto f = task.get_future();
+		std::thread(std::move(task), i).join();
+		if (f.get() != i + 1) abort();
+	});
+}
+
+int main()
+{
+	using namespace std::chrono_literals;
+	device::Led led;
+	std::printf("name,count,ns/spawn\n");
+	for (;;)
+	{
+		test();
+		std::this_thread::sleep_for(100ms);
+		led.tick();
+	}
+}
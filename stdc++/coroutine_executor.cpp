@@ -0,0 +1,267 @@
+#include "stm32f4_discovery.h"
+#include <os.h>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+
+using namespace device;
+using namespace stateos;
+
+// stackless coroutines multiplexed on a single kernel task;
+// sleeping coroutines wait in a heap ordered by deadline and cost nothing until they are due,
+// every other co_await adapter polls the non-blocking variant of the kernel call,
+// so a suspended coroutine never blocks the hosting task;
+// coroutine frames are allocated from the newlib heap
+
+namespace coro {
+
+struct Event
+{
+	virtual bool ready() = 0;
+	bool await_ready() { return ready(); }
+	template<class P>
+	void await_suspend( std::coroutine_handle<P> h ) { h.promise().event = this; }
+	void await_resume() {}
+};
+
+template<class F>
+struct When : Event
+{
+	When( F f ): fun{f} {}
+	bool ready() override { return fun(); }
+	F fun;
+};
+
+template<class F>
+When<F> when( F f ) { return When<F>(f); }
+
+inline bool due( cnt_t time )
+{
+	return static_cast<std::make_signed_t<cnt_t>>(sys_time() - time) >= 0;
+}
+
+struct Sleep
+{
+	cnt_t time;
+	bool await_ready() { return due(time); }
+	template<class P>
+	void await_suspend( std::coroutine_handle<P> h ) { h.promise().time = time; h.promise().asleep = true; }
+	void await_resume() {}
+};
+
+// a deadline already in the past completes at once
+inline Sleep sleepUntil( cnt_t time )
+{
+	return Sleep{time};
+}
+
+inline Sleep sleepFor( cnt_t delay )
+{
+	return Sleep{sys_time() + delay};
+}
+
+inline auto take( Semaphore &sem )
+{
+	return when([&]{ return sem.take() == E_SUCCESS; });
+}
+
+// the hosting task owns the mutex on behalf of the coroutine that took it;
+// a mutex already owned by the hosting task is held by a sibling coroutine, even if it is recursive,
+// so a coroutine must not take the same mutex twice
+inline auto take( Mutex &mtx )
+{
+	return when([&]{ return mtx.owner == nullptr && mtx.take() == E_SUCCESS; });
+}
+
+inline auto take( Flag &flg, unsigned flags, char mode = flgAll )
+{
+	return when([&, flags, mode]{ return flg.take(flags, mode) == E_SUCCESS; });
+}
+
+template<unsigned limit_>
+auto take( EventQueueT<limit_> &evq, unsigned &event )
+{
+	return when([&]{ return evq.take(event) == E_SUCCESS; });
+}
+
+template<unsigned limit_, class C>
+auto take( MessageQueueTT<limit_, C> &msg, C &data )
+{
+	return when([&]{ return msg.take(&data) == E_SUCCESS; });
+}
+
+// completes when the one-shot timer has expired
+inline auto take( Timer &tmr )
+{
+	return when([&]{ return tmr.take() == E_SUCCESS; });
+}
+
+struct Routine
+{
+	struct promise_type
+	{
+		Event        *event  {};
+		promise_type *next   {};
+		cnt_t         time   {};
+		bool          asleep {};
+
+		Routine get_return_object() { return Routine{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+		std::suspend_always initial_suspend() { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+class Executor
+{
+	using promise = Routine::promise_type;
+	using handle  = std::coroutine_handle<promise>;
+
+	promise *head {};            // coroutines to be resumed or polled
+	std::vector<promise *> heap; // sleeping coroutines, the earliest deadline first
+
+	static bool later( promise *a, promise *b )
+	{
+		return static_cast<std::make_signed_t<cnt_t>>(a->time - b->time) > 0;
+	}
+
+	void sleep( promise *p )
+	{
+		heap.push_back(p);
+		std::push_heap(heap.begin(), heap.end(), later);
+	}
+
+	// move the coroutines whose deadline has passed to the front of the polled list
+	void wake()
+	{
+		while (!heap.empty() && due(heap.front()->time))
+		{
+			std::pop_heap(heap.begin(), heap.end(), later);
+			promise *p = heap.back();
+			heap.pop_back();
+			p->asleep = false;
+			p->next = head;
+			head = p;
+		}
+	}
+
+public:
+
+	void spawn( Routine r )
+	{
+		r.handle.promise().next = head;
+		head = &r.handle.promise();
+	}
+
+	// resume every coroutine that is due or whose awaited event is ready;
+	// when none was, sleep until the earliest deadline, or for a tick while kernel objects are being polled;
+	// returns when all coroutines have completed
+	void run()
+	{
+		while (head != nullptr || !heap.empty())
+		{
+			bool busy = false;
+			wake();
+			for (auto p = &head; *p != nullptr; )
+			{
+				auto h = handle::from_promise(**p);
+				if (h.promise().event != nullptr && !h.promise().event->ready())
+				{
+					p = &h.promise().next;
+					continue;
+				}
+				h.promise().event = nullptr;
+				h.resume();
+				busy = true;
+				if (h.done())
+				{
+					*p = h.promise().next;
+					h.destroy();
+				}
+				else if (h.promise().asleep)
+				{
+					*p = h.promise().next;
+					sleep(&h.promise());
+				}
+				else
+					p = &h.promise().next;
+			}
+			if (busy)
+				continue;
+			if (head != nullptr)
+				thisTask::delay(1);
+			else if (!due(heap.front()->time))
+				thisTask::sleepUntil(heap.front()->time);
+		}
+	}
+};
+
+} // namespace coro
+
+constexpr unsigned sessions = 1000;
+constexpr unsigned tokens   = 8; // per tick, above the average demand of the sessions
+
+auto led = Led();
+auto sem = Semaphore(0);
+auto evq = EventQueueT<1>();
+
+unsigned served = 0;
+
+coro::Routine session( unsigned id )
+{
+	for (;;)
+	{
+		co_await coro::sleepFor(100 + id % 100);
+		co_await coro::take(sem);
+		served++;
+	}
+}
+
+coro::Routine monitor()
+{
+	unsigned x;
+
+	for (;;)
+	{
+		co_await coro::take(evq, x);
+		led = x;
+	}
+}
+
+void producer()
+{
+	unsigned x = 1;
+
+	for (;;)
+	{
+		for (unsigned i = 0; i < SEC; i++)
+		{
+			thisTask::delay(1);
+			for (unsigned n = 0; n < tokens; n++)
+				sem.give();
+		}
+		evq.give(x);
+		x = (x << 1) | (x >> 3);
+	}
+}
+
+auto prod = Task(producer);
+
+int main()
+{
+	auto exe = coro::Executor();
+
+	for (unsigned i = 0; i < sessions; i++)
+		exe.spawn(session(i));
+	exe.spawn(monitor());
+
+	prod.start();
+	exe.run();
+}
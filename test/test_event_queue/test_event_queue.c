@@ -4,6 +4,7 @@ void test_event_queue()
 {
 	UNIT_Notify();
 	TEST_Add(test_event_queue_1);
+	TEST_Add(test_event_queue_4);
 #ifndef __CSMC__
 	TEST_Add(test_event_queue_2);
 	TEST_Add(test_event_queue_3);
@@ -0,0 +1,51 @@
+#include "test.h"
+
+static_EVQ(evq3, 1);
+
+static unsigned sent[2];
+
+static void proc2()
+{
+	unsigned received;
+	int result;
+
+	result = evq_wait(evq3, &received);           ASSERT_success(result);
+	                                              ASSERT(received == sent[0]);
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	result = evq_give(evq3, sent[0]);             ASSERT_success(result);
+	result = evq_send(evq3, sent[1]);             ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned received;
+	int result;
+
+	         sent[0] = (unsigned)rand();
+	         sent[1] = (unsigned)rand();
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = evq_wait(evq3, &received);           ASSERT_success(result);
+	                                              ASSERT(received == sent[0]);
+	result = evq_wait(evq3, &received);           ASSERT_success(result);
+	                                              ASSERT(received == sent[1]);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	result = evq_give(evq3, sent[0]);             ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = evq_take(evq3, &received);           ASSERT_timeout(result);
+}
+
+void test_event_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
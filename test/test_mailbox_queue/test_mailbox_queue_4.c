@@ -0,0 +1,51 @@
+#include "test.h"
+
+static_BOX(box3, 1, sizeof(unsigned));
+
+static unsigned sent[2];
+
+static void proc2()
+{
+	unsigned received;
+	int result;
+
+	result = box_wait(box3, &received);           ASSERT_success(result);
+	                                              ASSERT(received == sent[0]);
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	result = box_give(box3, &sent[0]);            ASSERT_success(result);
+	result = box_send(box3, &sent[1]);            ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned received;
+	int result;
+
+	         sent[0] = (unsigned)rand();
+	         sent[1] = (unsigned)rand();
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = box_wait(box3, &received);           ASSERT_success(result);
+	                                              ASSERT(received == sent[0]);
+	result = box_wait(box3, &received);           ASSERT_success(result);
+	                                              ASSERT(received == sent[1]);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	result = box_give(box3, &sent[0]);            ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = box_take(box3, &received);           ASSERT_timeout(result);
+}
+
+void test_mailbox_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
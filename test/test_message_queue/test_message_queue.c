@@ -4,6 +4,7 @@ void test_message_queue()
 {
 	UNIT_Notify();
 	TEST_Add(test_message_queue_1);
+	TEST_Add(test_message_queue_4);
 #ifndef __CSMC__
 	TEST_Add(test_message_queue_2);
 	TEST_Add(test_message_queue_3);
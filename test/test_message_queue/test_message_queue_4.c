@@ -0,0 +1,58 @@
+#include "test.h"
+
+#define SIZE sizeof(unsigned)
+
+static_MSG(msg3, 1, SIZE);
+
+static unsigned sent[2];
+
+static void proc2()
+{
+	int result;
+	unsigned value;
+	unsigned read = SIZE;
+
+	result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+	                                              ASSERT(read == SIZE);
+	                                              ASSERT(value == sent[0]);
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	result = msg_give(msg3, &sent[0], SIZE);      ASSERT_success(result);
+	result = msg_send(msg3, &sent[1], SIZE);      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	unsigned value;
+	unsigned read = SIZE;
+
+	         sent[0] = (unsigned)rand();
+	         sent[1] = (unsigned)rand();
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+	                                              ASSERT(read == SIZE);
+	                                              ASSERT(value == sent[0]);
+	result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+	                                              ASSERT(read == SIZE);
+	                                              ASSERT(value == sent[1]);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	result = msg_give(msg3, &sent[0], SIZE);      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = msg_take(msg3, &value, SIZE, &read); ASSERT_timeout(result);
+}
+
+void test_message_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}